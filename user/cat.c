@@ -3,7 +3,7 @@
 #include "kernel/fcntl.h"
 #include "user/user.h"
 
-char buf[512];
+char buf[4096];
 
 void
 cat(int fd)
@@ -6,7 +6,7 @@
 #include "kernel/fcntl.h"
 #include "user/user.h"
 
-char buf[1024];
+char buf[4096];
 int match(char*, char*);
 
 void
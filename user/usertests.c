@@ -3167,15 +3167,17 @@ int
 countfree()
 {
   int n = 0;
+  int chunk = 1024;   // pages per sbrk; halved on failure until one page fails
   uint64 sz0 = (uint64)sbrk(0);
-  while(1){
-    char *a = sbrk(PGSIZE);
+  while(chunk > 0){
+    char *a = sbrk(chunk * PGSIZE);
     if(a == SBRK_ERROR){
-      break;
+      chunk /= 2;
+      continue;
     }
-    n += 1;
+    n += chunk;
   }
-  sbrk(-((uint64)sbrk(0) - sz0));  
+  sbrk(-((uint64)sbrk(0) - sz0));
   return n;
 }
 
@@ -4,7 +4,7 @@
 #include "kernel/fcntl.h"
 #include "user/user.h"
 
-char buf[512];
+char buf[4096];
 
 void
 wc(int fd, char *name)